@@ -0,0 +1,221 @@
+// precision.h
+
+
+#pragma once
+
+#ifndef PRECISION_H
+#define PRECISION_H
+
+#include <opencv2/opencv.hpp>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+/**
+ * @enum Precision
+ * @brief Формат хранения коэффициентов Хаара в памяти.
+ *
+ * Вычисления всегда ведутся во float; формат определяет только то,
+ * в каком виде промежуточные и итоговые плоскости лежат в cv::Mat.
+ */
+enum class Precision : int {
+    FP32,   ///< float, CV_32FC1
+    FP16,   ///< IEEE half, CV_16FC1
+    BF16    ///< bfloat16 (старшие 16 бит float), CV_16UC1
+};
+
+
+/**
+ * @struct FP32Storage
+ * @brief Хранение коэффициентов без потери точности.
+ */
+struct FP32Storage {
+    using type = float;
+    static constexpr int depth = CV_32F;
+
+    static float load(type v) { return v; }
+    static type store(float v) { return v; }
+};
+
+
+/**
+ * @struct FP16Storage
+ * @brief Хранение коэффициентов в IEEE half.
+ *
+ * При сборке с -mf16c преобразование выполняется инструкциями F16C,
+ * иначе используется программная реализация с округлением к ближайшему чётному.
+ */
+struct FP16Storage {
+    using type = uint16_t;
+    static constexpr int depth = CV_16F;
+
+    static float load(type v)
+    {
+#if defined(__F16C__)
+        return _cvtsh_ss(v);
+#else
+        uint32_t sign = uint32_t(v & 0x8000) << 16;
+        uint32_t exp = (v >> 10) & 0x1F;
+        uint32_t mant = v & 0x3FF;
+        uint32_t bits;
+        if (exp == 0x1F) bits = sign | 0x7F800000 | (mant << 13) | (mant ? 0x400000 : 0);  // Inf / NaN
+        else if (exp != 0) bits = sign | ((exp + 112) << 23) | (mant << 13);
+        else if (mant == 0) bits = sign;
+        else {
+            // Денормализованное half: нормализуем мантиссу
+            exp = 113;
+            while (!(mant & 0x400)) { mant <<= 1; exp--; }
+            bits = sign | (exp << 23) | ((mant & 0x3FF) << 13);
+        }
+        float f;
+        std::memcpy(&f, &bits, sizeof(f));
+        return f;
+#endif
+    }
+
+    static type store(float v)
+    {
+#if defined(__F16C__)
+        return _cvtss_sh(v, _MM_FROUND_TO_NEAREST_INT);
+#else
+        uint32_t bits;
+        std::memcpy(&bits, &v, sizeof(bits));
+        type sign = (bits >> 16) & 0x8000;
+        uint32_t abs = bits & 0x7FFFFFFF;
+        if (abs > 0x7F800000) return sign | 0x7E00 | ((abs >> 13) & 0x3FF);  // NaN
+        if (abs >= 0x477FF000) return sign | 0x7C00;                          // переполнение -> Inf
+        if (abs < 0x38800000) {
+            // Денормализованное half или ноль
+            if (abs < 0x33000000) return sign;
+            uint32_t shift = 126 - (abs >> 23);
+            uint32_t m = (abs & 0x7FFFFF) | 0x800000;
+            uint32_t r = m >> shift;
+            uint32_t rem = m & ((1u << shift) - 1);
+            uint32_t half = 1u << (shift - 1);
+            if (rem > half || (rem == half && (r & 1))) r++;
+            return sign | type(r);
+        }
+        uint32_t r = abs - 0x38000000;
+        r += 0xFFF + ((r >> 13) & 1);
+        return sign | type(r >> 13);
+#endif
+    }
+};
+
+
+/**
+ * @struct BF16Storage
+ * @brief Хранение коэффициентов в bfloat16.
+ *
+ * Тот же порядок, что у float, но 8 бит мантиссы. Округление к ближайшему чётному.
+ */
+struct BF16Storage {
+    using type = uint16_t;
+    static constexpr int depth = CV_16U;
+
+    static float load(type v)
+    {
+        uint32_t bits = uint32_t(v) << 16;
+        float f;
+        std::memcpy(&f, &bits, sizeof(f));
+        return f;
+    }
+
+    static type store(float v)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &v, sizeof(bits));
+        if ((bits & 0x7FFFFFFF) > 0x7F800000) return type((bits >> 16) | 0x40);  // NaN остаётся тихим NaN
+        bits += 0x7FFF + ((bits >> 16) & 1);
+        return type(bits >> 16);
+    }
+};
+
+
+/**
+ * @brief Возвращает тип cv::Mat для плоскости коэффициентов заданного формата.
+ */
+inline int precision_mat_type(Precision precision)
+{
+    switch (precision) {
+    case Precision::FP16: return CV_16FC1;
+    case Precision::BF16: return CV_16UC1;
+    default:              return CV_32FC1;
+    }
+}
+
+
+/**
+ * @brief Переводит плоскость в формат хранения без промежуточной float-копии.
+ * @param src Входная плоскость (CV_8UC1 или CV_32FC1).
+ * @param dst Выходная плоскость в формате precision.
+ * @param precision Формат хранения.
+ * @param scale Множитель, применяемый к значениям src.
+ */
+inline void narrow_plane(const cv::Mat& src, cv::Mat& dst, Precision precision, double scale = 1.0)
+{
+    CV_Assert(src.type() == CV_8UC1 || src.type() == CV_32FC1);
+    switch (precision) {
+    case Precision::FP16:
+        src.convertTo(dst, CV_16F, scale);
+        break;
+    case Precision::BF16: {
+        cv::Mat out(src.rows, src.cols, CV_16UC1);
+        float k = float(scale);
+        for (int y = 0; y < src.rows; y++) {
+            uint16_t* d = out.ptr<uint16_t>(y);
+            if (src.depth() == CV_8U) {
+                const uchar* s = src.ptr<uchar>(y);
+                for (int x = 0; x < src.cols; x++)
+                    d[x] = BF16Storage::store(s[x] * k);
+            }
+            else {
+                const float* s = src.ptr<float>(y);
+                for (int x = 0; x < src.cols; x++)
+                    d[x] = BF16Storage::store(s[x] * k);
+            }
+        }
+        dst = out;
+        break;
+    }
+    default:
+        src.convertTo(dst, CV_32F, scale);
+        break;
+    }
+}
+
+
+/**
+ * @brief Переводит плоскость из формата хранения в CV_32FC1.
+ * @param src Входная плоскость в формате precision.
+ * @param dst Выходная плоскость (CV_32FC1).
+ * @param precision Формат хранения.
+ */
+inline void widen_plane(const cv::Mat& src, cv::Mat& dst, Precision precision)
+{
+    CV_Assert(src.type() == precision_mat_type(precision));
+    switch (precision) {
+    case Precision::FP16:
+        src.convertTo(dst, CV_32F);
+        break;
+    case Precision::BF16: {
+        cv::Mat out(src.rows, src.cols, CV_32FC1);
+        for (int y = 0; y < src.rows; y++) {
+            const uint16_t* s = src.ptr<uint16_t>(y);
+            float* d = out.ptr<float>(y);
+            for (int x = 0; x < src.cols; x++)
+                d[x] = BF16Storage::load(s[x]);
+        }
+        dst = out;
+        break;
+    }
+    default:
+        if (&src != &dst) src.copyTo(dst);
+        break;
+    }
+}
+
+#endif // PRECISION_H
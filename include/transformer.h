@@ -13,6 +13,8 @@
 #include <iostream>
 #include <stdio.h>
 
+#include "precision.h"
+
 using namespace cv;
 using namespace std;
 
@@ -100,6 +102,21 @@ public:
      * @param SHRINKAGE_T Пороговое значение для фильтрации.
      */
     void apply_inv_Haar(cv::Mat& channel, cv::Mat& out_channel, int NIter, Shrinktype SHRINKTYPE, float SHRINKAGE_T);
+
+
+    /**
+     * @brief Задаёт формат хранения коэффициентов (FP32, FP16 или BF16).
+     * @details Действует со следующего forward_transform; прямой и обратный проходы всегда
+     * использует формат, в котором были получены текущие коэффициенты.
+     * @param precision Формат хранения промежуточных и итоговых плоскостей.
+     */
+    void set_precision(Precision precision);
+
+
+    /**
+     * @brief Возвращает текущий формат хранения коэффициентов.
+     */
+    Precision get_precision() const;
     
 
 private:
@@ -121,18 +138,27 @@ private:
     /// @brief Максимальное количество уровней разложения по умолчанию
     int max_levels_ = 3;
 
+    /// @brief Формат хранения коэффициентов по умолчанию.
+    Precision precision_ = Precision::FP32;
+
+    /// @brief Формат, в котором procces_channels разложил каналы (по нему работают прямой и обратный проходы).
+    Precision coef_precision_ = Precision::FP32;
+
 
     /**
      * @brief Выполняет прямое 2D-преобразование Хаара.
-     * @param src Входной канал (тип CV_32FC1).
-     * @param dst Выходной канал (тип CV_32FC1).
+     * @tparam Storage Формат хранения коэффициентов (FP32Storage, FP16Storage, BF16Storage).
+     * @param src Входной канал (тип Storage::depth, 1 канал).
+     * @param dst Выходной канал (тип Storage::depth, 1 канал).
      * @param NIter Количество уровней декомпозиции.
      */
+    template <typename Storage>
     void cvHaarWavelet(cv::Mat& src, cv::Mat& dst, int NIter)
     {
+        using T = typename Storage::type;
         float coef_c, coef_dh, coef_dv, coef_dd;
-        assert(src.type() == CV_32FC1);
-        assert(dst.type() == CV_32FC1);
+        CV_Assert(src.type() == CV_MAKETYPE(Storage::depth, 1));
+        CV_Assert(dst.type() == CV_MAKETYPE(Storage::depth, 1));
         int width = src.cols;
         int height = src.rows;
         for (int k = 0;k < NIter; k++)
@@ -142,10 +168,10 @@ private:
                 for (int x = 0; x < (width >> (k + 1)); x++)
                 {
                     // Чтение 2×2 блока
-                    float a = src.at<float>(2 * y, 2 * x);
-                    float b = src.at<float>(2 * y, 2 * x + 1);
-                    float c = src.at<float>(2 * y + 1, 2 * x);
-                    float d = src.at<float>(2 * y + 1, 2 * x + 1);
+                    float a = Storage::load(src.at<T>(2 * y, 2 * x));
+                    float b = Storage::load(src.at<T>(2 * y, 2 * x + 1));
+                    float c = Storage::load(src.at<T>(2 * y + 1, 2 * x));
+                    float d = Storage::load(src.at<T>(2 * y + 1, 2 * x + 1));
 
                     // Вычисление коэффициентов Хаара
                     coef_c = (a + b + c + d) * 0.5;
@@ -156,10 +182,10 @@ private:
                     float half_width = width >> (k + 1);
                     float half_height = height >> (k + 1);
 
-                    dst.at<float>(y, x) = coef_c;  // LL (приближённое значение)
-                    dst.at<float>(y, x + half_width) = coef_dh;  // LH (горизонталь)
-                    dst.at<float>(y + half_height, x) = coef_dv; // HL (вертикаль)
-                    dst.at<float>(y + half_height, x + half_width) = coef_dd; // HH (диагональ)
+                    dst.at<T>(y, x) = Storage::store(coef_c);  // LL (приближённое значение)
+                    dst.at<T>(y, x + half_width) = Storage::store(coef_dh);  // LH (горизонталь)
+                    dst.at<T>(y + half_height, x) = Storage::store(coef_dv); // HL (вертикаль)
+                    dst.at<T>(y + half_height, x + half_width) = Storage::store(coef_dd); // HH (диагональ)
                 }
             }
             dst.copyTo(src);
@@ -167,6 +193,71 @@ private:
     }
 
 
+    /**
+     * @brief Выполняет обратное 2D-преобразование Хаара для заданного формата хранения.
+     * @tparam Storage Формат хранения коэффициентов (FP32Storage, FP16Storage, BF16Storage).
+     * @param channel Канал с коэффициентами Хаара.
+     * @param out_channel Выходной канал (восстановленный).
+     * @param NIter Количество уровней.
+     * @param SHRINKAGE_TYPE Тип пороговой фильтрации.
+     * @param SHRINKAGE_T Пороговое значение для фильтрации.
+     */
+    template <typename Storage>
+    void cvInvHaarWavelet(cv::Mat& channel, cv::Mat& out_channel, int NIter, Shrinktype SHRINKAGE_TYPE, float SHRINKAGE_T)
+    {
+        using T = typename Storage::type;
+        float c, dh, dv, dd;
+        CV_Assert(channel.type() == CV_MAKETYPE(Storage::depth, 1));
+        CV_Assert(out_channel.type() == CV_MAKETYPE(Storage::depth, 1));
+        int width = channel.cols;
+        int height = channel.rows;
+
+        // NIter - number of iterations 
+        for (int k = NIter;k > 0;k--)
+        {
+            for (int y = 0;y < (height >> k);y++)
+            {
+                for (int x = 0; x < (width >> k);x++)
+                {
+                    c = Storage::load(channel.at<T>(y, x));
+                    dh = Storage::load(channel.at<T>(y, x + (width >> k)));
+                    dv = Storage::load(channel.at<T>(y + (height >> k), x));
+                    dd = Storage::load(channel.at<T>(y + (height >> k), x + (width >> k)));
+
+                    // (shrinkage)
+                    switch (SHRINKAGE_TYPE)
+                    {
+                    case Shrinktype::HARD:
+                        dh = hard_shrink(dh, SHRINKAGE_T);
+                        dv = hard_shrink(dv, SHRINKAGE_T);
+                        dd = hard_shrink(dd, SHRINKAGE_T);
+                        break;
+                    case Shrinktype::SOFT:
+                        dh = soft_shrink(dh, SHRINKAGE_T);
+                        dv = soft_shrink(dv, SHRINKAGE_T);
+                        dd = soft_shrink(dd, SHRINKAGE_T);
+                        break;
+                    case Shrinktype::GARROT:
+                        dh = Garrot_shrink(dh, SHRINKAGE_T);
+                        dv = Garrot_shrink(dv, SHRINKAGE_T);
+                        dd = Garrot_shrink(dd, SHRINKAGE_T);
+                        break;
+                    }
+
+                    //-------------------
+                    out_channel.at<T>(y * 2, x * 2) = Storage::store(0.5f * (c + dh + dv + dd));
+                    out_channel.at<T>(y * 2, x * 2 + 1) = Storage::store(0.5f * (c - dh + dv - dd));
+                    out_channel.at<T>(y * 2 + 1, x * 2) = Storage::store(0.5f * (c + dh - dv - dd));
+                    out_channel.at<T>(y * 2 + 1, x * 2 + 1) = Storage::store(0.5f * (c - dh - dv + dd));
+                }
+            }
+            cv::Mat C = channel(cv::Rect(0, 0, width >> (k - 1), height >> (k - 1)));
+            cv::Mat D = out_channel(cv::Rect(0, 0, width >> (k - 1), height >> (k - 1)));
+            D.copyTo(C);
+        }
+    }
+
+
     /**
      * @brief Возвращает знак числа.
      * @param x Входное число.
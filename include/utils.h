@@ -13,6 +13,7 @@
 #include <iostream>
 #include <stdio.h>
 #include <fstream>
+#include <sstream>
 #include <filesystem> 
 
 #include "transformer.h"
@@ -30,6 +31,12 @@ double calculateSSIM(const cv::Mat& i1, const cv::Mat& i2);
 std::string shrinkTypeToString(HaarTransformer::Shrinktype type);
 
 
+std::string precisionToString(Precision precision);
+
+
+bool parsePrecision(const std::string& str, Precision& precision);
+
+
 void process_test_mode(std::string input_dir, std::string output_csv);
 
 #endif // UTILS_H
\ No newline at end of file
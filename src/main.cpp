@@ -18,7 +18,7 @@ int main(int argc, char* argv[]) {
     if (argc < 2) {
         std::cerr << "Usage:\n"
             << "  Test mode: " << argv[0] << " test <input_dir> <output_csv>\n"
-            << "  Work mode: " << argv[0] << " work <src_path> <dst_path> <NIter> <shrinktype> <shrinkage>\n";
+            << "  Work mode: " << argv[0] << " work <src_path> <dst_path> <NIter> <shrinktype> <shrinkage> [precision]\n";
         return 1;
     }
 
@@ -51,9 +51,9 @@ int main(int argc, char* argv[]) {
     }
     else if (mode == "work") {
         //    
-        if (argc != 7) {
-            std::cerr << "Error: work mode requires 5 additional arguments\n"
-                << "Usage: " << argv[0] << " work <src_path> <dst_path> <NIter> <shrinktype> <shrinkage>\n";
+        if (argc != 7 && argc != 8) {
+            std::cerr << "Error: work mode requires 5 or 6 additional arguments\n"
+                << "Usage: " << argv[0] << " work <src_path> <dst_path> <NIter> <shrinktype> <shrinkage> [precision]\n";
             return 1;
         }
 
@@ -62,6 +62,7 @@ int main(int argc, char* argv[]) {
         int n_iter = std::stoi(argv[4]);
         std::string shrinktype_str(argv[5]);
         float shrinkage = std::stof(argv[6]);
+        std::string precision_str(argc == 8 ? argv[7] : "FP32");
 
         //   
         if (!fs::exists(src_path)) {
@@ -88,8 +89,16 @@ int main(int argc, char* argv[]) {
             return 1;
         }
 
+        //   
+        Precision precision;
+        if (!parsePrecision(precision_str, precision)) {
+            std::cerr << "Error: invalid precision. Use FP32, FP16 or BF16\n";
+            return 1;
+        }
+
         //  
         HaarTransformer trans;
+        trans.set_precision(precision);
         trans.upload_image(src_path);
         trans.forward_transform(n_iter);
         cv::Mat result = trans.backward_transform(n_iter, shrinktype, shrinkage);
@@ -105,7 +114,8 @@ int main(int argc, char* argv[]) {
             << "  Result: " << dst_path << "\n"
             << "  Parameters: NIter=" << n_iter
             << ", Shrinktype=" << shrinktype_str
-            << ", Shrinkage=" << shrinkage << std::endl;
+            << ", Shrinkage=" << shrinkage
+            << ", Precision=" << precision_str << std::endl;
 
     }
     else {
@@ -12,10 +12,11 @@ HaarTransformer::HaarTransformer() {
 void HaarTransformer::procces_channels(){
 
     cv::split(local_image, splitted_channels);
+    coef_precision_ = precision_;
 
-    //     float:
+    //       (  8 ):
     for (auto& c : splitted_channels) {
-        c.convertTo(c, CV_32FC1, 1.0 / 255.0);
+        narrow_plane(c, c, coef_precision_, 1.0 / 255.0);
     }
 
 }
@@ -39,8 +40,18 @@ void HaarTransformer::upload_image(std::string path_to_image) {
 
 void HaarTransformer::apply_Haar(int NIter) {
     for (int i = 0; i < 3; ++i) {
-        haar_channels[i] = cv::Mat(local_image.rows, local_image.cols, CV_32FC1);
-        cvHaarWavelet(splitted_channels[i], haar_channels[i], NIter);
+        haar_channels[i] = cv::Mat(local_image.rows, local_image.cols, precision_mat_type(coef_precision_));
+        switch (coef_precision_) {
+        case Precision::FP16:
+            cvHaarWavelet<FP16Storage>(splitted_channels[i], haar_channels[i], NIter);
+            break;
+        case Precision::BF16:
+            cvHaarWavelet<BF16Storage>(splitted_channels[i], haar_channels[i], NIter);
+            break;
+        default:
+            cvHaarWavelet<FP32Storage>(splitted_channels[i], haar_channels[i], NIter);
+            break;
+        }
     }
 
 }
@@ -69,6 +80,7 @@ cv::Mat HaarTransformer::backward_transform(int NIter, Shrinktype shrinktype = S
     }
 
     for (auto& c : splitted_channels) {
+        widen_plane(c, c, coef_precision_);
         c.convertTo(c, CV_8UC1, 255.0);  //  0255
     }
 
@@ -83,53 +95,25 @@ cv::Mat HaarTransformer::backward_transform(int NIter, Shrinktype shrinktype = S
 
 void HaarTransformer::apply_inv_Haar(cv::Mat& channel, cv::Mat& out_channel, int NIter, Shrinktype SHRINKAGE_TYPE = Shrinktype::NONE, float SHRINKAGE_T = 50)
 {
-    float c, dh, dv, dd;
-    assert(channel.type() == CV_32FC1);
-    assert(out_channel.type() == CV_32FC1);
-    int width = channel.cols;
-    int height = channel.rows;
-
-    // NIter - number of iterations 
-    for (int k = NIter;k > 0;k--)
-    {
-        for (int y = 0;y < (height >> k);y++)
-        {
-            for (int x = 0; x < (width >> k);x++)
-            {
-                c = channel.at<float>(y, x);
-                dh = channel.at<float>(y, x + (width >> k));
-                dv = channel.at<float>(y + (height >> k), x);
-                dd = channel.at<float>(y + (height >> k), x + (width >> k));
-
-                // (shrinkage)
-                switch (SHRINKAGE_TYPE)
-                {
-                case Shrinktype::HARD:
-                    dh = hard_shrink(dh, SHRINKAGE_T);
-                    dv = hard_shrink(dv, SHRINKAGE_T);
-                    dd = hard_shrink(dd, SHRINKAGE_T);
-                    break;
-                case Shrinktype::SOFT:
-                    dh = soft_shrink(dh, SHRINKAGE_T);
-                    dv = soft_shrink(dv, SHRINKAGE_T);
-                    dd = soft_shrink(dd, SHRINKAGE_T);
-                    break;
-                case Shrinktype::GARROT:
-                    dh = Garrot_shrink(dh, SHRINKAGE_T);
-                    dv = Garrot_shrink(dv, SHRINKAGE_T);
-                    dd = Garrot_shrink(dd, SHRINKAGE_T);
-                    break;
-                }
-
-                //-------------------
-                out_channel.at<float>(y * 2, x * 2) = 0.5 * (c + dh + dv + dd);
-                out_channel.at<float>(y * 2, x * 2 + 1) = 0.5 * (c - dh + dv - dd);
-                out_channel.at<float>(y * 2 + 1, x * 2) = 0.5 * (c + dh - dv - dd);
-                out_channel.at<float>(y * 2 + 1, x * 2 + 1) = 0.5 * (c - dh - dv + dd);
-            }
-        }
-        cv::Mat C = channel(cv::Rect(0, 0, width >> (k - 1), height >> (k - 1)));
-        cv::Mat D = out_channel(cv::Rect(0, 0, width >> (k - 1), height >> (k - 1)));
-        D.copyTo(C);
+    switch (coef_precision_) {
+    case Precision::FP16:
+        cvInvHaarWavelet<FP16Storage>(channel, out_channel, NIter, SHRINKAGE_TYPE, SHRINKAGE_T);
+        break;
+    case Precision::BF16:
+        cvInvHaarWavelet<BF16Storage>(channel, out_channel, NIter, SHRINKAGE_TYPE, SHRINKAGE_T);
+        break;
+    default:
+        cvInvHaarWavelet<FP32Storage>(channel, out_channel, NIter, SHRINKAGE_TYPE, SHRINKAGE_T);
+        break;
     }
+}
+
+
+void HaarTransformer::set_precision(Precision precision) {
+    precision_ = precision;
+}
+
+
+Precision HaarTransformer::get_precision() const {
+    return precision_;
 }
\ No newline at end of file
@@ -78,6 +78,25 @@ std::string shrinkTypeToString(HaarTransformer::Shrinktype type) {
 }
 
 
+std::string precisionToString(Precision precision) {
+    switch (precision) {
+    case Precision::FP32: return "FP32";
+    case Precision::FP16: return "FP16";
+    case Precision::BF16: return "BF16";
+    default:              return "UNKNOWN";
+    }
+}
+
+
+bool parsePrecision(const std::string& str, Precision& precision) {
+    if (str == "FP32") precision = Precision::FP32;
+    else if (str == "FP16") precision = Precision::FP16;
+    else if (str == "BF16") precision = Precision::BF16;
+    else return false;
+    return true;
+}
+
+
 void process_test_mode(std::string input_dir, std::string output_csv){
     namespace fs = std::filesystem;
 
@@ -90,10 +109,16 @@ void process_test_mode(std::string input_dir, std::string output_csv){
         HaarTransformer::Shrinktype::GARROT
     };
     const std::vector<float> shrinkage_values = { 25.0f, 50.0f, 80.0f };
+    // FP32  :       PSNR
+    const std::vector<Precision> precisions = {
+        Precision::FP32,
+        Precision::FP16,
+        Precision::BF16
+    };
 
     //     
     std::ofstream csv_file(output_csv);
-    csv_file << "Filename,NIter,Shrinktype,Shrinkage,PSNR,SSIM\n";
+    csv_file << "Filename,NIter,Shrinktype,Shrinkage,Precision,PSNR,dPSNR,SSIM\n";
 
     //     
     HaarTransformer trans;
@@ -114,41 +139,64 @@ void process_test_mode(std::string input_dir, std::string output_csv){
         for (int n_iter : n_iter_values) {
             for (HaarTransformer::Shrinktype shrink_type : shrink_types) {
                 for (float shrinkage : shrinkage_values) {
-                    try {
-                        //  
-                        trans.upload_image(entry.path().string());
-                        trans.forward_transform(n_iter);
-                        cv::Mat reconstructed = trans.backward_transform(
-                            n_iter, shrink_type, shrinkage);
-
-                        //  
-                        double psnr_val = getPSNR(original, reconstructed);
-                        double ssim_val = calculateSSIM(original, reconstructed);
-
-                        //  
-                        csv_file << filename << ","
-                            << n_iter << ","
-                            << shrinkTypeToString(shrink_type) << ","
-                            << shrinkage << ","
-                            << std::fixed << std::setprecision(4)
-                            << psnr_val << ","
-                            << ssim_val << "\n";
-
-                        //  
-                        std::cout << "Processed " << filename
-                            << " | NIter=" << n_iter
-                            << " | Type=" << shrinkTypeToString(shrink_type)
-                            << " | Shrink=" << shrinkage
-                            << " | PSNR=" << psnr_val
-                            << " | SSIM=" << ssim_val << std::endl;
-
-                        total_processed++;
-                    }
-                    catch (const std::exception& e) {
-                        std::cerr << "Error processing " << filename
-                            << " with params (" << n_iter << ", "
-                            << shrinkTypeToString(shrink_type) << ", "
-                            << shrinkage << "): " << e.what() << std::endl;
+                    //  PSNR  FP32; getPSNR  0   ,
+                    //        
+                    double psnr_fp32 = 0;
+                    bool has_fp32 = false;
+                    for (Precision precision : precisions) {
+                        try {
+                            //  
+                            trans.set_precision(precision);
+                            trans.upload_image(entry.path().string());
+                            trans.forward_transform(n_iter);
+                            cv::Mat reconstructed = trans.backward_transform(
+                                n_iter, shrink_type, shrinkage);
+
+                            //  
+                            double psnr_val = getPSNR(original, reconstructed);
+                            double ssim_val = calculateSSIM(original, reconstructed);
+                            if (precision == Precision::FP32 && psnr_val > 0) {
+                                psnr_fp32 = psnr_val;
+                                has_fp32 = true;
+                            }
+
+                            std::string dpsnr_str = "nan";
+                            if (has_fp32 && psnr_val > 0) {
+                                std::ostringstream dpsnr_ss;
+                                dpsnr_ss << std::fixed << std::setprecision(4) << psnr_val - psnr_fp32;
+                                dpsnr_str = dpsnr_ss.str();
+                            }
+
+                            //  
+                            csv_file << filename << ","
+                                << n_iter << ","
+                                << shrinkTypeToString(shrink_type) << ","
+                                << shrinkage << ","
+                                << precisionToString(precision) << ","
+                                << std::fixed << std::setprecision(4)
+                                << psnr_val << ","
+                                << dpsnr_str << ","
+                                << ssim_val << "\n";
+
+                            //  
+                            std::cout << "Processed " << filename
+                                << " | NIter=" << n_iter
+                                << " | Type=" << shrinkTypeToString(shrink_type)
+                                << " | Shrink=" << shrinkage
+                                << " | Prec=" << precisionToString(precision)
+                                << " | PSNR=" << psnr_val
+                                << " | dPSNR=" << dpsnr_str
+                                << " | SSIM=" << ssim_val << std::endl;
+
+                            total_processed++;
+                        }
+                        catch (const std::exception& e) {
+                            std::cerr << "Error processing " << filename
+                                << " with params (" << n_iter << ", "
+                                << shrinkTypeToString(shrink_type) << ", "
+                                << shrinkage << ", "
+                                << precisionToString(precision) << "): " << e.what() << std::endl;
+                        }
                     }
                 }
             }